@@ -0,0 +1,85 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/demos/benchmark/assets/img_benchmark_cogwheel_alpha16.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/benchmark/assets/img_benchmark_cogwheel_alpha16.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/benchmark/assets/img_benchmark_cogwheel_alpha16.c.o.d"
+  "/root/repo/demos/benchmark/assets/img_benchmark_cogwheel_argb.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/benchmark/assets/img_benchmark_cogwheel_argb.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/benchmark/assets/img_benchmark_cogwheel_argb.c.o.d"
+  "/root/repo/demos/benchmark/assets/img_benchmark_cogwheel_chroma_keyed.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/benchmark/assets/img_benchmark_cogwheel_chroma_keyed.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/benchmark/assets/img_benchmark_cogwheel_chroma_keyed.c.o.d"
+  "/root/repo/demos/benchmark/assets/img_benchmark_cogwheel_indexed16.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/benchmark/assets/img_benchmark_cogwheel_indexed16.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/benchmark/assets/img_benchmark_cogwheel_indexed16.c.o.d"
+  "/root/repo/demos/benchmark/assets/img_benchmark_cogwheel_rgb.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/benchmark/assets/img_benchmark_cogwheel_rgb.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/benchmark/assets/img_benchmark_cogwheel_rgb.c.o.d"
+  "/root/repo/demos/benchmark/assets/img_benchmark_cogwheel_rgb565a8.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/benchmark/assets/img_benchmark_cogwheel_rgb565a8.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/benchmark/assets/img_benchmark_cogwheel_rgb565a8.c.o.d"
+  "/root/repo/demos/benchmark/assets/lv_font_bechmark_montserrat_12_compr_az.c.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/benchmark/assets/lv_font_bechmark_montserrat_12_compr_az.c.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/benchmark/assets/lv_font_bechmark_montserrat_12_compr_az.c.c.o.d"
+  "/root/repo/demos/benchmark/assets/lv_font_bechmark_montserrat_16_compr_az.c.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/benchmark/assets/lv_font_bechmark_montserrat_16_compr_az.c.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/benchmark/assets/lv_font_bechmark_montserrat_16_compr_az.c.c.o.d"
+  "/root/repo/demos/benchmark/assets/lv_font_bechmark_montserrat_28_compr_az.c.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/benchmark/assets/lv_font_bechmark_montserrat_28_compr_az.c.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/benchmark/assets/lv_font_bechmark_montserrat_28_compr_az.c.c.o.d"
+  "/root/repo/demos/benchmark/lv_demo_benchmark.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/benchmark/lv_demo_benchmark.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/benchmark/lv_demo_benchmark.c.o.d"
+  "/root/repo/demos/flex_layout/lv_demo_flex_layout_ctrl_pad.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/flex_layout/lv_demo_flex_layout_ctrl_pad.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/flex_layout/lv_demo_flex_layout_ctrl_pad.c.o.d"
+  "/root/repo/demos/flex_layout/lv_demo_flex_layout_flex_loader.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/flex_layout/lv_demo_flex_layout_flex_loader.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/flex_layout/lv_demo_flex_layout_flex_loader.c.o.d"
+  "/root/repo/demos/flex_layout/lv_demo_flex_layout_main.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/flex_layout/lv_demo_flex_layout_main.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/flex_layout/lv_demo_flex_layout_main.c.o.d"
+  "/root/repo/demos/flex_layout/lv_demo_flex_layout_view.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/flex_layout/lv_demo_flex_layout_view.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/flex_layout/lv_demo_flex_layout_view.c.o.d"
+  "/root/repo/demos/flex_layout/lv_demo_flex_layout_view_child_node.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/flex_layout/lv_demo_flex_layout_view_child_node.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/flex_layout/lv_demo_flex_layout_view_child_node.c.o.d"
+  "/root/repo/demos/flex_layout/lv_demo_flex_layout_view_ctrl_pad.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/flex_layout/lv_demo_flex_layout_view_ctrl_pad.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/flex_layout/lv_demo_flex_layout_view_ctrl_pad.c.o.d"
+  "/root/repo/demos/keypad_encoder/lv_demo_keypad_encoder.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/keypad_encoder/lv_demo_keypad_encoder.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/keypad_encoder/lv_demo_keypad_encoder.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_btn_corner_large.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_corner_large.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_corner_large.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_btn_list_pause.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_list_pause.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_list_pause.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_btn_list_pause_large.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_list_pause_large.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_list_pause_large.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_btn_list_play.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_list_play.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_list_play.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_btn_list_play_large.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_list_play_large.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_list_play_large.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_btn_loop.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_loop.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_loop.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_btn_loop_large.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_loop_large.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_loop_large.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_btn_next.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_next.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_next.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_btn_next_large.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_next_large.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_next_large.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_btn_pause.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_pause.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_pause.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_btn_pause_large.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_pause_large.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_pause_large.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_btn_play.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_play.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_play.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_btn_play_large.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_play_large.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_play_large.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_btn_prev.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_prev.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_prev.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_btn_prev_large.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_prev_large.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_prev_large.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_btn_rnd.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_rnd.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_rnd.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_btn_rnd_large.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_rnd_large.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_btn_rnd_large.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_corner_left.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_corner_left.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_corner_left.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_corner_left_large.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_corner_left_large.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_corner_left_large.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_corner_right.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_corner_right.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_corner_right.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_corner_right_large.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_corner_right_large.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_corner_right_large.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_cover_1.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_cover_1.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_cover_1.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_cover_2.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_cover_2.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_cover_2.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_cover_3.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_cover_3.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_cover_3.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_icon_1.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_icon_1.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_icon_1.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_icon_1_large.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_icon_1_large.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_icon_1_large.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_icon_2.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_icon_2.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_icon_2.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_icon_2_large.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_icon_2_large.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_icon_2_large.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_icon_3.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_icon_3.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_icon_3.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_icon_3_large.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_icon_3_large.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_icon_3_large.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_icon_4.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_icon_4.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_icon_4.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_icon_4_large.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_icon_4_large.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_icon_4_large.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_list_border.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_list_border.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_list_border.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_list_border_large.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_list_border_large.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_list_border_large.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_logo.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_logo.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_logo.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_slider_knob.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_slider_knob.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_slider_knob.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_slider_knob_large.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_slider_knob_large.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_slider_knob_large.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_wave_bottom.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_wave_bottom.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_wave_bottom.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_wave_bottom_large.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_wave_bottom_large.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_wave_bottom_large.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_wave_top.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_wave_top.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_wave_top.c.o.d"
+  "/root/repo/demos/music/assets/img_lv_demo_music_wave_top_large.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_wave_top_large.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/assets/img_lv_demo_music_wave_top_large.c.o.d"
+  "/root/repo/demos/music/lv_demo_music.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/lv_demo_music.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/lv_demo_music.c.o.d"
+  "/root/repo/demos/music/lv_demo_music_list.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/lv_demo_music_list.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/lv_demo_music_list.c.o.d"
+  "/root/repo/demos/music/lv_demo_music_main.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/lv_demo_music_main.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/music/lv_demo_music_main.c.o.d"
+  "/root/repo/demos/stress/lv_demo_stress.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/stress/lv_demo_stress.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/stress/lv_demo_stress.c.o.d"
+  "/root/repo/demos/widgets/assets/img_clothes.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/widgets/assets/img_clothes.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/widgets/assets/img_clothes.c.o.d"
+  "/root/repo/demos/widgets/assets/img_demo_widgets_avatar.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/widgets/assets/img_demo_widgets_avatar.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/widgets/assets/img_demo_widgets_avatar.c.o.d"
+  "/root/repo/demos/widgets/assets/img_lvgl_logo.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/widgets/assets/img_lvgl_logo.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/widgets/assets/img_lvgl_logo.c.o.d"
+  "/root/repo/demos/widgets/lv_demo_widgets.c" "CMakeFiles/lvgl_demos.dir/root/repo/demos/widgets/lv_demo_widgets.c.o" "gcc" "CMakeFiles/lvgl_demos.dir/root/repo/demos/widgets/lv_demo_widgets.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_b_16BIT/CMakeFiles/lvgl.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_common.dir/src/lv_test_indev.c.o"
+  "CMakeFiles/test_common.dir/src/lv_test_indev.c.o.d"
+  "CMakeFiles/test_common.dir/src/lv_test_init.c.o"
+  "CMakeFiles/test_common.dir/src/lv_test_init.c.o.d"
+  "CMakeFiles/test_common.dir/src/test_assets/animimg001.c.o"
+  "CMakeFiles/test_common.dir/src/test_assets/animimg001.c.o.d"
+  "CMakeFiles/test_common.dir/src/test_assets/animimg002.c.o"
+  "CMakeFiles/test_common.dir/src/test_assets/animimg002.c.o.d"
+  "CMakeFiles/test_common.dir/src/test_assets/animimg003.c.o"
+  "CMakeFiles/test_common.dir/src/test_assets/animimg003.c.o.d"
+  "CMakeFiles/test_common.dir/src/test_assets/font_1.c.o"
+  "CMakeFiles/test_common.dir/src/test_assets/font_1.c.o.d"
+  "CMakeFiles/test_common.dir/src/test_assets/font_2.c.o"
+  "CMakeFiles/test_common.dir/src/test_assets/font_2.c.o.d"
+  "CMakeFiles/test_common.dir/src/test_assets/font_3.c.o"
+  "CMakeFiles/test_common.dir/src/test_assets/font_3.c.o.d"
+  "CMakeFiles/test_common.dir/src/test_assets/img_caret_down.c.o"
+  "CMakeFiles/test_common.dir/src/test_assets/img_caret_down.c.o.d"
+  "CMakeFiles/test_common.dir/src/test_assets/ubuntu_font.c.o"
+  "CMakeFiles/test_common.dir/src/test_assets/ubuntu_font.c.o.d"
+  "CMakeFiles/test_common.dir/unity/unity.c.o"
+  "CMakeFiles/test_common.dir/unity/unity.c.o.d"
+  "CMakeFiles/test_common.dir/unity/unity_support.c.o"
+  "CMakeFiles/test_common.dir/unity/unity_support.c.o.d"
+  "libtest_common.a"
+  "libtest_common.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_common.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,218 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/core/lv_disp.c" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_disp.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_disp.c.o.d"
+  "/root/repo/src/core/lv_event.c" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_event.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_event.c.o.d"
+  "/root/repo/src/core/lv_group.c" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_group.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_group.c.o.d"
+  "/root/repo/src/core/lv_indev.c" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_indev.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_indev.c.o.d"
+  "/root/repo/src/core/lv_indev_scroll.c" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_indev_scroll.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_indev_scroll.c.o.d"
+  "/root/repo/src/core/lv_obj.c" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj.c.o.d"
+  "/root/repo/src/core/lv_obj_class.c" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj_class.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj_class.c.o.d"
+  "/root/repo/src/core/lv_obj_draw.c" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj_draw.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj_draw.c.o.d"
+  "/root/repo/src/core/lv_obj_pos.c" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj_pos.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj_pos.c.o.d"
+  "/root/repo/src/core/lv_obj_scroll.c" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj_scroll.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj_scroll.c.o.d"
+  "/root/repo/src/core/lv_obj_style.c" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj_style.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj_style.c.o.d"
+  "/root/repo/src/core/lv_obj_style_gen.c" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj_style_gen.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj_style_gen.c.o.d"
+  "/root/repo/src/core/lv_obj_tree.c" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj_tree.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj_tree.c.o.d"
+  "/root/repo/src/core/lv_refr.c" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_refr.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_refr.c.o.d"
+  "/root/repo/src/core/lv_theme.c" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_theme.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/core/lv_theme.c.o.d"
+  "/root/repo/src/draw/arm2d/lv_gpu_arm2d.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/arm2d/lv_gpu_arm2d.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/arm2d/lv_gpu_arm2d.c.o.d"
+  "/root/repo/src/draw/gd32_ipa/lv_gpu_gd32_ipa.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/gd32_ipa/lv_gpu_gd32_ipa.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/gd32_ipa/lv_gpu_gd32_ipa.c.o.d"
+  "/root/repo/src/draw/lv_draw.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw.c.o.d"
+  "/root/repo/src/draw/lv_draw_arc.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_arc.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_arc.c.o.d"
+  "/root/repo/src/draw/lv_draw_img.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_img.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_img.c.o.d"
+  "/root/repo/src/draw/lv_draw_label.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_label.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_label.c.o.d"
+  "/root/repo/src/draw/lv_draw_layer.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_layer.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_layer.c.o.d"
+  "/root/repo/src/draw/lv_draw_layer_cache.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_layer_cache.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_layer_cache.c.o.d"
+  "/root/repo/src/draw/lv_draw_line.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_line.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_line.c.o.d"
+  "/root/repo/src/draw/lv_draw_list.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_list.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_list.c.o.d"
+  "/root/repo/src/draw/lv_draw_mask.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_mask.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_mask.c.o.d"
+  "/root/repo/src/draw/lv_draw_rect.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_rect.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_rect.c.o.d"
+  "/root/repo/src/draw/lv_draw_transform.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_transform.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_transform.c.o.d"
+  "/root/repo/src/draw/lv_draw_triangle.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_triangle.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_triangle.c.o.d"
+  "/root/repo/src/draw/lv_img_buf.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_img_buf.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_img_buf.c.o.d"
+  "/root/repo/src/draw/lv_img_cache.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_img_cache.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_img_cache.c.o.d"
+  "/root/repo/src/draw/lv_img_cache_builtin.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_img_cache_builtin.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_img_cache_builtin.c.o.d"
+  "/root/repo/src/draw/lv_img_decoder.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_img_decoder.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_img_decoder.c.o.d"
+  "/root/repo/src/draw/nxp/lv_gpu_nxp.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/lv_gpu_nxp.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/lv_gpu_nxp.c.o.d"
+  "/root/repo/src/draw/nxp/pxp/lv_draw_pxp_blend.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/pxp/lv_draw_pxp_blend.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/pxp/lv_draw_pxp_blend.c.o.d"
+  "/root/repo/src/draw/nxp/pxp/lv_gpu_nxp_pxp.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/pxp/lv_gpu_nxp_pxp.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/pxp/lv_gpu_nxp_pxp.c.o.d"
+  "/root/repo/src/draw/nxp/pxp/lv_gpu_nxp_pxp_osa.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/pxp/lv_gpu_nxp_pxp_osa.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/pxp/lv_gpu_nxp_pxp_osa.c.o.d"
+  "/root/repo/src/draw/nxp/vglite/lv_draw_vglite_arc.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/vglite/lv_draw_vglite_arc.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/vglite/lv_draw_vglite_arc.c.o.d"
+  "/root/repo/src/draw/nxp/vglite/lv_draw_vglite_blend.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/vglite/lv_draw_vglite_blend.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/vglite/lv_draw_vglite_blend.c.o.d"
+  "/root/repo/src/draw/nxp/vglite/lv_draw_vglite_rect.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/vglite/lv_draw_vglite_rect.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/vglite/lv_draw_vglite_rect.c.o.d"
+  "/root/repo/src/draw/nxp/vglite/lv_gpu_nxp_vglite.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/vglite/lv_gpu_nxp_vglite.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/vglite/lv_gpu_nxp_vglite.c.o.d"
+  "/root/repo/src/draw/sdl/lv_draw_sdl.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl.c.o.d"
+  "/root/repo/src/draw/sdl/lv_draw_sdl_arc.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_arc.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_arc.c.o.d"
+  "/root/repo/src/draw/sdl/lv_draw_sdl_bg.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_bg.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_bg.c.o.d"
+  "/root/repo/src/draw/sdl/lv_draw_sdl_composite.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_composite.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_composite.c.o.d"
+  "/root/repo/src/draw/sdl/lv_draw_sdl_img.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_img.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_img.c.o.d"
+  "/root/repo/src/draw/sdl/lv_draw_sdl_label.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_label.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_label.c.o.d"
+  "/root/repo/src/draw/sdl/lv_draw_sdl_layer.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_layer.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_layer.c.o.d"
+  "/root/repo/src/draw/sdl/lv_draw_sdl_line.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_line.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_line.c.o.d"
+  "/root/repo/src/draw/sdl/lv_draw_sdl_mask.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_mask.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_mask.c.o.d"
+  "/root/repo/src/draw/sdl/lv_draw_sdl_polygon.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_polygon.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_polygon.c.o.d"
+  "/root/repo/src/draw/sdl/lv_draw_sdl_rect.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_rect.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_rect.c.o.d"
+  "/root/repo/src/draw/sdl/lv_draw_sdl_stack_blur.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_stack_blur.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_stack_blur.c.o.d"
+  "/root/repo/src/draw/sdl/lv_draw_sdl_texture_cache.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_texture_cache.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_texture_cache.c.o.d"
+  "/root/repo/src/draw/sdl/lv_draw_sdl_utils.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_utils.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_utils.c.o.d"
+  "/root/repo/src/draw/stm32_dma2d/lv_gpu_stm32_dma2d.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/stm32_dma2d/lv_gpu_stm32_dma2d.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/stm32_dma2d/lv_gpu_stm32_dma2d.c.o.d"
+  "/root/repo/src/draw/sw/lv_draw_sw.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw.c.o.d"
+  "/root/repo/src/draw/sw/lv_draw_sw_arc.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_arc.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_arc.c.o.d"
+  "/root/repo/src/draw/sw/lv_draw_sw_blend.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_blend.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_blend.c.o.d"
+  "/root/repo/src/draw/sw/lv_draw_sw_blend_simd.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_blend_simd.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_blend_simd.c.o.d"
+  "/root/repo/src/draw/sw/lv_draw_sw_dither.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_dither.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_dither.c.o.d"
+  "/root/repo/src/draw/sw/lv_draw_sw_gradient.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_gradient.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_gradient.c.o.d"
+  "/root/repo/src/draw/sw/lv_draw_sw_img.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_img.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_img.c.o.d"
+  "/root/repo/src/draw/sw/lv_draw_sw_layer.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_layer.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_layer.c.o.d"
+  "/root/repo/src/draw/sw/lv_draw_sw_letter.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_letter.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_letter.c.o.d"
+  "/root/repo/src/draw/sw/lv_draw_sw_line.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_line.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_line.c.o.d"
+  "/root/repo/src/draw/sw/lv_draw_sw_polygon.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_polygon.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_polygon.c.o.d"
+  "/root/repo/src/draw/sw/lv_draw_sw_raster.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_raster.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_raster.c.o.d"
+  "/root/repo/src/draw/sw/lv_draw_sw_rect.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_rect.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_rect.c.o.d"
+  "/root/repo/src/draw/sw/lv_draw_sw_transform.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_transform.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_transform.c.o.d"
+  "/root/repo/src/draw/sw/lv_draw_sw_worker.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_worker.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_worker.c.o.d"
+  "/root/repo/src/draw/swm341_dma2d/lv_gpu_swm341_dma2d.c" "CMakeFiles/lvgl.dir/root/repo/src/draw/swm341_dma2d/lv_gpu_swm341_dma2d.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/draw/swm341_dma2d/lv_gpu_swm341_dma2d.c.o.d"
+  "/root/repo/src/font/lv_font.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font.c.o.d"
+  "/root/repo/src/font/lv_font_dejavu_16_persian_hebrew.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_dejavu_16_persian_hebrew.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_dejavu_16_persian_hebrew.c.o.d"
+  "/root/repo/src/font/lv_font_fmt_txt.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_fmt_txt.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_fmt_txt.c.o.d"
+  "/root/repo/src/font/lv_font_loader.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_loader.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_loader.c.o.d"
+  "/root/repo/src/font/lv_font_montserrat_10.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_10.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_10.c.o.d"
+  "/root/repo/src/font/lv_font_montserrat_12.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_12.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_12.c.o.d"
+  "/root/repo/src/font/lv_font_montserrat_12_subpx.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_12_subpx.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_12_subpx.c.o.d"
+  "/root/repo/src/font/lv_font_montserrat_14.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_14.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_14.c.o.d"
+  "/root/repo/src/font/lv_font_montserrat_16.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_16.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_16.c.o.d"
+  "/root/repo/src/font/lv_font_montserrat_18.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_18.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_18.c.o.d"
+  "/root/repo/src/font/lv_font_montserrat_20.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_20.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_20.c.o.d"
+  "/root/repo/src/font/lv_font_montserrat_22.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_22.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_22.c.o.d"
+  "/root/repo/src/font/lv_font_montserrat_24.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_24.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_24.c.o.d"
+  "/root/repo/src/font/lv_font_montserrat_26.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_26.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_26.c.o.d"
+  "/root/repo/src/font/lv_font_montserrat_28.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_28.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_28.c.o.d"
+  "/root/repo/src/font/lv_font_montserrat_28_compressed.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_28_compressed.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_28_compressed.c.o.d"
+  "/root/repo/src/font/lv_font_montserrat_30.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_30.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_30.c.o.d"
+  "/root/repo/src/font/lv_font_montserrat_32.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_32.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_32.c.o.d"
+  "/root/repo/src/font/lv_font_montserrat_34.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_34.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_34.c.o.d"
+  "/root/repo/src/font/lv_font_montserrat_36.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_36.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_36.c.o.d"
+  "/root/repo/src/font/lv_font_montserrat_38.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_38.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_38.c.o.d"
+  "/root/repo/src/font/lv_font_montserrat_40.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_40.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_40.c.o.d"
+  "/root/repo/src/font/lv_font_montserrat_42.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_42.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_42.c.o.d"
+  "/root/repo/src/font/lv_font_montserrat_44.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_44.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_44.c.o.d"
+  "/root/repo/src/font/lv_font_montserrat_46.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_46.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_46.c.o.d"
+  "/root/repo/src/font/lv_font_montserrat_48.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_48.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_48.c.o.d"
+  "/root/repo/src/font/lv_font_montserrat_8.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_8.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_8.c.o.d"
+  "/root/repo/src/font/lv_font_simsun_16_cjk.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_simsun_16_cjk.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_simsun_16_cjk.c.o.d"
+  "/root/repo/src/font/lv_font_unscii_16.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_unscii_16.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_unscii_16.c.o.d"
+  "/root/repo/src/font/lv_font_unscii_8.c" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_unscii_8.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_unscii_8.c.o.d"
+  "/root/repo/src/hal/lv_hal_disp.c" "CMakeFiles/lvgl.dir/root/repo/src/hal/lv_hal_disp.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/hal/lv_hal_disp.c.o.d"
+  "/root/repo/src/hal/lv_hal_indev.c" "CMakeFiles/lvgl.dir/root/repo/src/hal/lv_hal_indev.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/hal/lv_hal_indev.c.o.d"
+  "/root/repo/src/hal/lv_hal_tick.c" "CMakeFiles/lvgl.dir/root/repo/src/hal/lv_hal_tick.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/hal/lv_hal_tick.c.o.d"
+  "/root/repo/src/layouts/flex/lv_flex.c" "CMakeFiles/lvgl.dir/root/repo/src/layouts/flex/lv_flex.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/layouts/flex/lv_flex.c.o.d"
+  "/root/repo/src/layouts/grid/lv_grid.c" "CMakeFiles/lvgl.dir/root/repo/src/layouts/grid/lv_grid.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/layouts/grid/lv_grid.c.o.d"
+  "/root/repo/src/libs/barcode/code128.c" "CMakeFiles/lvgl.dir/root/repo/src/libs/barcode/code128.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/libs/barcode/code128.c.o.d"
+  "/root/repo/src/libs/barcode/lv_barcode.c" "CMakeFiles/lvgl.dir/root/repo/src/libs/barcode/lv_barcode.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/libs/barcode/lv_barcode.c.o.d"
+  "/root/repo/src/libs/bmp/lv_bmp.c" "CMakeFiles/lvgl.dir/root/repo/src/libs/bmp/lv_bmp.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/libs/bmp/lv_bmp.c.o.d"
+  "/root/repo/src/libs/ffmpeg/lv_ffmpeg.c" "CMakeFiles/lvgl.dir/root/repo/src/libs/ffmpeg/lv_ffmpeg.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/libs/ffmpeg/lv_ffmpeg.c.o.d"
+  "/root/repo/src/libs/freetype/lv_freetype.c" "CMakeFiles/lvgl.dir/root/repo/src/libs/freetype/lv_freetype.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/libs/freetype/lv_freetype.c.o.d"
+  "/root/repo/src/libs/freetype/lv_ftsystem.c" "CMakeFiles/lvgl.dir/root/repo/src/libs/freetype/lv_ftsystem.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/libs/freetype/lv_ftsystem.c.o.d"
+  "/root/repo/src/libs/fsdrv/lv_fs_cbfs.c" "CMakeFiles/lvgl.dir/root/repo/src/libs/fsdrv/lv_fs_cbfs.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/libs/fsdrv/lv_fs_cbfs.c.o.d"
+  "/root/repo/src/libs/fsdrv/lv_fs_fatfs.c" "CMakeFiles/lvgl.dir/root/repo/src/libs/fsdrv/lv_fs_fatfs.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/libs/fsdrv/lv_fs_fatfs.c.o.d"
+  "/root/repo/src/libs/fsdrv/lv_fs_posix.c" "CMakeFiles/lvgl.dir/root/repo/src/libs/fsdrv/lv_fs_posix.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/libs/fsdrv/lv_fs_posix.c.o.d"
+  "/root/repo/src/libs/fsdrv/lv_fs_stdio.c" "CMakeFiles/lvgl.dir/root/repo/src/libs/fsdrv/lv_fs_stdio.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/libs/fsdrv/lv_fs_stdio.c.o.d"
+  "/root/repo/src/libs/fsdrv/lv_fs_win32.c" "CMakeFiles/lvgl.dir/root/repo/src/libs/fsdrv/lv_fs_win32.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/libs/fsdrv/lv_fs_win32.c.o.d"
+  "/root/repo/src/libs/gif/gifdec.c" "CMakeFiles/lvgl.dir/root/repo/src/libs/gif/gifdec.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/libs/gif/gifdec.c.o.d"
+  "/root/repo/src/libs/gif/lv_gif.c" "CMakeFiles/lvgl.dir/root/repo/src/libs/gif/lv_gif.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/libs/gif/lv_gif.c.o.d"
+  "/root/repo/src/libs/png/lodepng.c" "CMakeFiles/lvgl.dir/root/repo/src/libs/png/lodepng.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/libs/png/lodepng.c.o.d"
+  "/root/repo/src/libs/png/lv_png.c" "CMakeFiles/lvgl.dir/root/repo/src/libs/png/lv_png.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/libs/png/lv_png.c.o.d"
+  "/root/repo/src/libs/qrcode/lv_qrcode.c" "CMakeFiles/lvgl.dir/root/repo/src/libs/qrcode/lv_qrcode.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/libs/qrcode/lv_qrcode.c.o.d"
+  "/root/repo/src/libs/qrcode/qrcodegen.c" "CMakeFiles/lvgl.dir/root/repo/src/libs/qrcode/qrcodegen.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/libs/qrcode/qrcodegen.c.o.d"
+  "/root/repo/src/libs/rlottie/lv_rlottie.c" "CMakeFiles/lvgl.dir/root/repo/src/libs/rlottie/lv_rlottie.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/libs/rlottie/lv_rlottie.c.o.d"
+  "/root/repo/src/libs/sjpg/lv_sjpg.c" "CMakeFiles/lvgl.dir/root/repo/src/libs/sjpg/lv_sjpg.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/libs/sjpg/lv_sjpg.c.o.d"
+  "/root/repo/src/libs/sjpg/tjpgd.c" "CMakeFiles/lvgl.dir/root/repo/src/libs/sjpg/tjpgd.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/libs/sjpg/tjpgd.c.o.d"
+  "/root/repo/src/libs/tiny_ttf/lv_tiny_ttf.c" "CMakeFiles/lvgl.dir/root/repo/src/libs/tiny_ttf/lv_tiny_ttf.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/libs/tiny_ttf/lv_tiny_ttf.c.o.d"
+  "/root/repo/src/misc/lv_anim.c" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_anim.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_anim.c.o.d"
+  "/root/repo/src/misc/lv_anim_timeline.c" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_anim_timeline.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_anim_timeline.c.o.d"
+  "/root/repo/src/misc/lv_area.c" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_area.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_area.c.o.d"
+  "/root/repo/src/misc/lv_async.c" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_async.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_async.c.o.d"
+  "/root/repo/src/misc/lv_bidi.c" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_bidi.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_bidi.c.o.d"
+  "/root/repo/src/misc/lv_color.c" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_color.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_color.c.o.d"
+  "/root/repo/src/misc/lv_fs.c" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_fs.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_fs.c.o.d"
+  "/root/repo/src/misc/lv_gc.c" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_gc.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_gc.c.o.d"
+  "/root/repo/src/misc/lv_ll.c" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_ll.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_ll.c.o.d"
+  "/root/repo/src/misc/lv_log.c" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_log.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_log.c.o.d"
+  "/root/repo/src/misc/lv_lru.c" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_lru.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_lru.c.o.d"
+  "/root/repo/src/misc/lv_malloc_builtin.c" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_malloc_builtin.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_malloc_builtin.c.o.d"
+  "/root/repo/src/misc/lv_math.c" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_math.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_math.c.o.d"
+  "/root/repo/src/misc/lv_mem.c" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_mem.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_mem.c.o.d"
+  "/root/repo/src/misc/lv_memcpy_builtin.c" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_memcpy_builtin.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_memcpy_builtin.c.o.d"
+  "/root/repo/src/misc/lv_printf.c" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_printf.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_printf.c.o.d"
+  "/root/repo/src/misc/lv_profiler.c" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_profiler.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_profiler.c.o.d"
+  "/root/repo/src/misc/lv_style.c" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_style.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_style.c.o.d"
+  "/root/repo/src/misc/lv_style_gen.c" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_style_gen.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_style_gen.c.o.d"
+  "/root/repo/src/misc/lv_templ.c" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_templ.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_templ.c.o.d"
+  "/root/repo/src/misc/lv_timer.c" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_timer.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_timer.c.o.d"
+  "/root/repo/src/misc/lv_tlsf.c" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_tlsf.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_tlsf.c.o.d"
+  "/root/repo/src/misc/lv_txt.c" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_txt.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_txt.c.o.d"
+  "/root/repo/src/misc/lv_txt_ap.c" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_txt_ap.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_txt_ap.c.o.d"
+  "/root/repo/src/misc/lv_utils.c" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_utils.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_utils.c.o.d"
+  "/root/repo/src/others/file_explorer/lv_file_explorer.c" "CMakeFiles/lvgl.dir/root/repo/src/others/file_explorer/lv_file_explorer.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/others/file_explorer/lv_file_explorer.c.o.d"
+  "/root/repo/src/others/fragment/lv_fragment.c" "CMakeFiles/lvgl.dir/root/repo/src/others/fragment/lv_fragment.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/others/fragment/lv_fragment.c.o.d"
+  "/root/repo/src/others/fragment/lv_fragment_manager.c" "CMakeFiles/lvgl.dir/root/repo/src/others/fragment/lv_fragment_manager.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/others/fragment/lv_fragment_manager.c.o.d"
+  "/root/repo/src/others/gridnav/lv_gridnav.c" "CMakeFiles/lvgl.dir/root/repo/src/others/gridnav/lv_gridnav.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/others/gridnav/lv_gridnav.c.o.d"
+  "/root/repo/src/others/ime/lv_ime_pinyin.c" "CMakeFiles/lvgl.dir/root/repo/src/others/ime/lv_ime_pinyin.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/others/ime/lv_ime_pinyin.c.o.d"
+  "/root/repo/src/others/imgfont/lv_imgfont.c" "CMakeFiles/lvgl.dir/root/repo/src/others/imgfont/lv_imgfont.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/others/imgfont/lv_imgfont.c.o.d"
+  "/root/repo/src/others/monkey/lv_monkey.c" "CMakeFiles/lvgl.dir/root/repo/src/others/monkey/lv_monkey.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/others/monkey/lv_monkey.c.o.d"
+  "/root/repo/src/others/msg/lv_msg.c" "CMakeFiles/lvgl.dir/root/repo/src/others/msg/lv_msg.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/others/msg/lv_msg.c.o.d"
+  "/root/repo/src/others/snapshot/lv_snapshot.c" "CMakeFiles/lvgl.dir/root/repo/src/others/snapshot/lv_snapshot.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/others/snapshot/lv_snapshot.c.o.d"
+  "/root/repo/src/themes/basic/lv_theme_basic.c" "CMakeFiles/lvgl.dir/root/repo/src/themes/basic/lv_theme_basic.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/themes/basic/lv_theme_basic.c.o.d"
+  "/root/repo/src/themes/default/lv_theme_default.c" "CMakeFiles/lvgl.dir/root/repo/src/themes/default/lv_theme_default.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/themes/default/lv_theme_default.c.o.d"
+  "/root/repo/src/themes/mono/lv_theme_mono.c" "CMakeFiles/lvgl.dir/root/repo/src/themes/mono/lv_theme_mono.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/themes/mono/lv_theme_mono.c.o.d"
+  "/root/repo/src/widgets/animimg/lv_animimg.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/animimg/lv_animimg.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/animimg/lv_animimg.c.o.d"
+  "/root/repo/src/widgets/arc/lv_arc.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/arc/lv_arc.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/arc/lv_arc.c.o.d"
+  "/root/repo/src/widgets/bar/lv_bar.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/bar/lv_bar.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/bar/lv_bar.c.o.d"
+  "/root/repo/src/widgets/btn/lv_btn.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/btn/lv_btn.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/btn/lv_btn.c.o.d"
+  "/root/repo/src/widgets/btnmatrix/lv_btnmatrix.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/btnmatrix/lv_btnmatrix.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/btnmatrix/lv_btnmatrix.c.o.d"
+  "/root/repo/src/widgets/calendar/lv_calendar.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/calendar/lv_calendar.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/calendar/lv_calendar.c.o.d"
+  "/root/repo/src/widgets/calendar/lv_calendar_header_arrow.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/calendar/lv_calendar_header_arrow.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/calendar/lv_calendar_header_arrow.c.o.d"
+  "/root/repo/src/widgets/calendar/lv_calendar_header_dropdown.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/calendar/lv_calendar_header_dropdown.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/calendar/lv_calendar_header_dropdown.c.o.d"
+  "/root/repo/src/widgets/canvas/lv_canvas.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/canvas/lv_canvas.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/canvas/lv_canvas.c.o.d"
+  "/root/repo/src/widgets/chart/lv_chart.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/chart/lv_chart.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/chart/lv_chart.c.o.d"
+  "/root/repo/src/widgets/checkbox/lv_checkbox.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/checkbox/lv_checkbox.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/checkbox/lv_checkbox.c.o.d"
+  "/root/repo/src/widgets/colorwheel/lv_colorwheel.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/colorwheel/lv_colorwheel.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/colorwheel/lv_colorwheel.c.o.d"
+  "/root/repo/src/widgets/dropdown/lv_dropdown.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/dropdown/lv_dropdown.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/dropdown/lv_dropdown.c.o.d"
+  "/root/repo/src/widgets/img/lv_img.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/img/lv_img.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/img/lv_img.c.o.d"
+  "/root/repo/src/widgets/imgbtn/lv_imgbtn.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/imgbtn/lv_imgbtn.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/imgbtn/lv_imgbtn.c.o.d"
+  "/root/repo/src/widgets/keyboard/lv_keyboard.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/keyboard/lv_keyboard.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/keyboard/lv_keyboard.c.o.d"
+  "/root/repo/src/widgets/label/lv_label.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/label/lv_label.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/label/lv_label.c.o.d"
+  "/root/repo/src/widgets/led/lv_led.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/led/lv_led.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/led/lv_led.c.o.d"
+  "/root/repo/src/widgets/line/lv_line.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/line/lv_line.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/line/lv_line.c.o.d"
+  "/root/repo/src/widgets/list/lv_list.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/list/lv_list.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/list/lv_list.c.o.d"
+  "/root/repo/src/widgets/menu/lv_menu.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/menu/lv_menu.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/menu/lv_menu.c.o.d"
+  "/root/repo/src/widgets/meter/lv_meter.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/meter/lv_meter.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/meter/lv_meter.c.o.d"
+  "/root/repo/src/widgets/msgbox/lv_msgbox.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/msgbox/lv_msgbox.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/msgbox/lv_msgbox.c.o.d"
+  "/root/repo/src/widgets/objx_templ/lv_objx_templ.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/objx_templ/lv_objx_templ.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/objx_templ/lv_objx_templ.c.o.d"
+  "/root/repo/src/widgets/roller/lv_roller.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/roller/lv_roller.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/roller/lv_roller.c.o.d"
+  "/root/repo/src/widgets/slider/lv_slider.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/slider/lv_slider.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/slider/lv_slider.c.o.d"
+  "/root/repo/src/widgets/span/lv_span.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/span/lv_span.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/span/lv_span.c.o.d"
+  "/root/repo/src/widgets/spinbox/lv_spinbox.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/spinbox/lv_spinbox.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/spinbox/lv_spinbox.c.o.d"
+  "/root/repo/src/widgets/spinner/lv_spinner.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/spinner/lv_spinner.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/spinner/lv_spinner.c.o.d"
+  "/root/repo/src/widgets/switch/lv_switch.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/switch/lv_switch.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/switch/lv_switch.c.o.d"
+  "/root/repo/src/widgets/table/lv_table.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/table/lv_table.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/table/lv_table.c.o.d"
+  "/root/repo/src/widgets/tabview/lv_tabview.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/tabview/lv_tabview.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/tabview/lv_tabview.c.o.d"
+  "/root/repo/src/widgets/textarea/lv_textarea.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/textarea/lv_textarea.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/textarea/lv_textarea.c.o.d"
+  "/root/repo/src/widgets/tileview/lv_tileview.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/tileview/lv_tileview.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/tileview/lv_tileview.c.o.d"
+  "/root/repo/src/widgets/win/lv_win.c" "CMakeFiles/lvgl.dir/root/repo/src/widgets/win/lv_win.c.o" "gcc" "CMakeFiles/lvgl.dir/root/repo/src/widgets/win/lv_win.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/src/lv_test_indev.c" "CMakeFiles/test_common.dir/src/lv_test_indev.c.o" "gcc" "CMakeFiles/test_common.dir/src/lv_test_indev.c.o.d"
+  "/root/repo/tests/src/lv_test_init.c" "CMakeFiles/test_common.dir/src/lv_test_init.c.o" "gcc" "CMakeFiles/test_common.dir/src/lv_test_init.c.o.d"
+  "/root/repo/tests/src/test_assets/animimg001.c" "CMakeFiles/test_common.dir/src/test_assets/animimg001.c.o" "gcc" "CMakeFiles/test_common.dir/src/test_assets/animimg001.c.o.d"
+  "/root/repo/tests/src/test_assets/animimg002.c" "CMakeFiles/test_common.dir/src/test_assets/animimg002.c.o" "gcc" "CMakeFiles/test_common.dir/src/test_assets/animimg002.c.o.d"
+  "/root/repo/tests/src/test_assets/animimg003.c" "CMakeFiles/test_common.dir/src/test_assets/animimg003.c.o" "gcc" "CMakeFiles/test_common.dir/src/test_assets/animimg003.c.o.d"
+  "/root/repo/tests/src/test_assets/font_1.c" "CMakeFiles/test_common.dir/src/test_assets/font_1.c.o" "gcc" "CMakeFiles/test_common.dir/src/test_assets/font_1.c.o.d"
+  "/root/repo/tests/src/test_assets/font_2.c" "CMakeFiles/test_common.dir/src/test_assets/font_2.c.o" "gcc" "CMakeFiles/test_common.dir/src/test_assets/font_2.c.o.d"
+  "/root/repo/tests/src/test_assets/font_3.c" "CMakeFiles/test_common.dir/src/test_assets/font_3.c.o" "gcc" "CMakeFiles/test_common.dir/src/test_assets/font_3.c.o.d"
+  "/root/repo/tests/src/test_assets/img_caret_down.c" "CMakeFiles/test_common.dir/src/test_assets/img_caret_down.c.o" "gcc" "CMakeFiles/test_common.dir/src/test_assets/img_caret_down.c.o.d"
+  "/root/repo/tests/src/test_assets/ubuntu_font.c" "CMakeFiles/test_common.dir/src/test_assets/ubuntu_font.c.o" "gcc" "CMakeFiles/test_common.dir/src/test_assets/ubuntu_font.c.o.d"
+  "/root/repo/tests/unity/unity.c" "CMakeFiles/test_common.dir/unity/unity.c.o" "gcc" "CMakeFiles/test_common.dir/unity/unity.c.o.d"
+  "/root/repo/tests/unity/unity_support.c" "CMakeFiles/test_common.dir/unity/unity_support.c.o" "gcc" "CMakeFiles/test_common.dir/unity/unity_support.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
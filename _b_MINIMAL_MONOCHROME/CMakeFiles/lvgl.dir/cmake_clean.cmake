@@ -0,0 +1,409 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_disp.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_disp.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_event.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_event.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_group.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_group.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_indev.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_indev.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_indev_scroll.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_indev_scroll.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj_class.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj_class.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj_draw.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj_draw.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj_pos.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj_pos.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj_scroll.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj_scroll.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj_style.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj_style.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj_style_gen.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj_style_gen.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj_tree.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_obj_tree.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_refr.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_refr.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_theme.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/core/lv_theme.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/arm2d/lv_gpu_arm2d.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/arm2d/lv_gpu_arm2d.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/gd32_ipa/lv_gpu_gd32_ipa.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/gd32_ipa/lv_gpu_gd32_ipa.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_arc.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_arc.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_img.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_img.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_label.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_label.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_layer.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_layer.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_layer_cache.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_layer_cache.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_line.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_line.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_list.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_list.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_mask.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_mask.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_rect.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_rect.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_transform.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_transform.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_triangle.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_draw_triangle.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_img_buf.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_img_buf.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_img_cache.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_img_cache.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_img_cache_builtin.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_img_cache_builtin.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_img_decoder.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/lv_img_decoder.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/lv_gpu_nxp.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/lv_gpu_nxp.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/pxp/lv_draw_pxp_blend.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/pxp/lv_draw_pxp_blend.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/pxp/lv_gpu_nxp_pxp.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/pxp/lv_gpu_nxp_pxp.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/pxp/lv_gpu_nxp_pxp_osa.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/pxp/lv_gpu_nxp_pxp_osa.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/vglite/lv_draw_vglite_arc.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/vglite/lv_draw_vglite_arc.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/vglite/lv_draw_vglite_blend.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/vglite/lv_draw_vglite_blend.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/vglite/lv_draw_vglite_rect.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/vglite/lv_draw_vglite_rect.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/vglite/lv_gpu_nxp_vglite.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/nxp/vglite/lv_gpu_nxp_vglite.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_arc.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_arc.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_bg.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_bg.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_composite.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_composite.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_img.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_img.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_label.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_label.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_layer.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_layer.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_line.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_line.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_mask.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_mask.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_polygon.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_polygon.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_rect.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_rect.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_stack_blur.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_stack_blur.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_texture_cache.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_texture_cache.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_utils.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sdl/lv_draw_sdl_utils.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/stm32_dma2d/lv_gpu_stm32_dma2d.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/stm32_dma2d/lv_gpu_stm32_dma2d.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_arc.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_arc.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_blend.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_blend.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_blend_simd.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_blend_simd.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_dither.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_dither.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_gradient.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_gradient.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_img.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_img.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_layer.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_layer.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_letter.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_letter.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_line.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_line.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_polygon.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_polygon.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_raster.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_raster.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_rect.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_rect.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_transform.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_transform.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_worker.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/sw/lv_draw_sw_worker.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/swm341_dma2d/lv_gpu_swm341_dma2d.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/draw/swm341_dma2d/lv_gpu_swm341_dma2d.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_dejavu_16_persian_hebrew.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_dejavu_16_persian_hebrew.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_fmt_txt.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_fmt_txt.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_loader.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_loader.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_10.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_10.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_12.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_12.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_12_subpx.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_12_subpx.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_14.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_14.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_16.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_16.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_18.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_18.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_20.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_20.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_22.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_22.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_24.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_24.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_26.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_26.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_28.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_28.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_28_compressed.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_28_compressed.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_30.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_30.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_32.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_32.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_34.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_34.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_36.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_36.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_38.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_38.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_40.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_40.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_42.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_42.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_44.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_44.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_46.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_46.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_48.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_48.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_8.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_montserrat_8.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_simsun_16_cjk.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_simsun_16_cjk.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_unscii_16.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_unscii_16.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_unscii_8.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/font/lv_font_unscii_8.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/hal/lv_hal_disp.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/hal/lv_hal_disp.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/hal/lv_hal_indev.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/hal/lv_hal_indev.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/hal/lv_hal_tick.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/hal/lv_hal_tick.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/layouts/flex/lv_flex.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/layouts/flex/lv_flex.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/layouts/grid/lv_grid.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/layouts/grid/lv_grid.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/barcode/code128.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/barcode/code128.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/barcode/lv_barcode.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/barcode/lv_barcode.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/bmp/lv_bmp.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/bmp/lv_bmp.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/ffmpeg/lv_ffmpeg.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/ffmpeg/lv_ffmpeg.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/freetype/lv_freetype.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/freetype/lv_freetype.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/freetype/lv_ftsystem.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/freetype/lv_ftsystem.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/fsdrv/lv_fs_cbfs.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/fsdrv/lv_fs_cbfs.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/fsdrv/lv_fs_fatfs.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/fsdrv/lv_fs_fatfs.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/fsdrv/lv_fs_posix.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/fsdrv/lv_fs_posix.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/fsdrv/lv_fs_stdio.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/fsdrv/lv_fs_stdio.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/fsdrv/lv_fs_win32.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/fsdrv/lv_fs_win32.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/gif/gifdec.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/gif/gifdec.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/gif/lv_gif.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/gif/lv_gif.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/png/lodepng.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/png/lodepng.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/png/lv_png.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/png/lv_png.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/qrcode/lv_qrcode.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/qrcode/lv_qrcode.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/qrcode/qrcodegen.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/qrcode/qrcodegen.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/rlottie/lv_rlottie.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/rlottie/lv_rlottie.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/sjpg/lv_sjpg.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/sjpg/lv_sjpg.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/sjpg/tjpgd.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/sjpg/tjpgd.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/tiny_ttf/lv_tiny_ttf.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/libs/tiny_ttf/lv_tiny_ttf.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_anim.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_anim.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_anim_timeline.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_anim_timeline.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_area.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_area.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_async.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_async.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_bidi.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_bidi.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_color.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_color.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_fs.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_fs.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_gc.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_gc.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_ll.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_ll.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_log.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_log.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_lru.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_lru.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_malloc_builtin.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_malloc_builtin.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_math.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_math.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_mem.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_mem.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_memcpy_builtin.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_memcpy_builtin.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_printf.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_printf.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_profiler.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_profiler.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_style.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_style.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_style_gen.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_style_gen.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_templ.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_templ.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_timer.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_timer.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_tlsf.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_tlsf.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_txt.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_txt.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_txt_ap.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_txt_ap.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_utils.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/misc/lv_utils.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/others/file_explorer/lv_file_explorer.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/others/file_explorer/lv_file_explorer.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/others/fragment/lv_fragment.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/others/fragment/lv_fragment.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/others/fragment/lv_fragment_manager.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/others/fragment/lv_fragment_manager.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/others/gridnav/lv_gridnav.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/others/gridnav/lv_gridnav.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/others/ime/lv_ime_pinyin.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/others/ime/lv_ime_pinyin.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/others/imgfont/lv_imgfont.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/others/imgfont/lv_imgfont.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/others/monkey/lv_monkey.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/others/monkey/lv_monkey.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/others/msg/lv_msg.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/others/msg/lv_msg.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/others/snapshot/lv_snapshot.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/others/snapshot/lv_snapshot.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/themes/basic/lv_theme_basic.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/themes/basic/lv_theme_basic.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/themes/default/lv_theme_default.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/themes/default/lv_theme_default.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/themes/mono/lv_theme_mono.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/themes/mono/lv_theme_mono.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/animimg/lv_animimg.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/animimg/lv_animimg.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/arc/lv_arc.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/arc/lv_arc.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/bar/lv_bar.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/bar/lv_bar.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/btn/lv_btn.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/btn/lv_btn.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/btnmatrix/lv_btnmatrix.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/btnmatrix/lv_btnmatrix.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/calendar/lv_calendar.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/calendar/lv_calendar.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/calendar/lv_calendar_header_arrow.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/calendar/lv_calendar_header_arrow.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/calendar/lv_calendar_header_dropdown.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/calendar/lv_calendar_header_dropdown.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/canvas/lv_canvas.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/canvas/lv_canvas.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/chart/lv_chart.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/chart/lv_chart.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/checkbox/lv_checkbox.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/checkbox/lv_checkbox.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/colorwheel/lv_colorwheel.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/colorwheel/lv_colorwheel.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/dropdown/lv_dropdown.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/dropdown/lv_dropdown.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/img/lv_img.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/img/lv_img.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/imgbtn/lv_imgbtn.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/imgbtn/lv_imgbtn.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/keyboard/lv_keyboard.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/keyboard/lv_keyboard.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/label/lv_label.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/label/lv_label.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/led/lv_led.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/led/lv_led.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/line/lv_line.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/line/lv_line.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/list/lv_list.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/list/lv_list.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/menu/lv_menu.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/menu/lv_menu.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/meter/lv_meter.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/meter/lv_meter.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/msgbox/lv_msgbox.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/msgbox/lv_msgbox.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/objx_templ/lv_objx_templ.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/objx_templ/lv_objx_templ.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/roller/lv_roller.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/roller/lv_roller.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/slider/lv_slider.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/slider/lv_slider.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/span/lv_span.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/span/lv_span.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/spinbox/lv_spinbox.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/spinbox/lv_spinbox.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/spinner/lv_spinner.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/spinner/lv_spinner.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/switch/lv_switch.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/switch/lv_switch.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/table/lv_table.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/table/lv_table.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/tabview/lv_tabview.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/tabview/lv_tabview.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/textarea/lv_textarea.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/textarea/lv_textarea.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/tileview/lv_tileview.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/tileview/lv_tileview.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/win/lv_win.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/src/widgets/win/lv_win.c.o.d"
+  "lib/liblvgl.a"
+  "lib/liblvgl.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/lvgl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()